@@ -5,11 +5,15 @@
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <memory>
 #include <fast_io.h>
 #include <fast_io_device.h>
 #include <fast_io_dsal/string.h>
 #include <fmt/core.h>
 #include <fmt/compile.h>
+#include <page_arena.h>
+#include <page_compare.h>
+#include <log_record.h>
 
 #define ROUNDS 5
 
@@ -70,36 +74,12 @@ inline benchmark_result run_bench(Func f, std::uint32_t iterations, std::uint32_
 }
 
 
-inline ::fast_io::string make_record_fastio(std::uint32_t i)
-{
-	std::uint32_t id = i * 2654435761u + 0x9e3779b9u;
-	std::uint64_t val = 0xDEADBEEFCAFEBABEull ^ (std::uint64_t)id * 1315423911ull;
-	std::uint32_t score = (id % 10007) + 3141;
-	std::uint32_t rate = score / ((id % 97) + 1);
-	::fast_io::string name{"fastio"};
-
-	// return fast_io::concat_fast_io(
-	// 	"ID=", width(scalar_placement::right, hex0xupper(id), 10, '0'),
-	// 	" VAL=", width(scalar_placement::right, hex0xupper(val), 18, '0'),
-	// 	" SCORE=", width(scalar_placement::right, strvw(score_s), 12),
-	// 	" RATE=", width(scalar_placement::right, strvw(rate_s), 10),
-	// 	" NAME=", left(strvw(name), 16, '.'));
-
-	return fast_io::concat_fast_io(
-		"ID=", width(scalar_placement::right, hex0xupper(id), 10, '0'),
-		" VAL=", width(scalar_placement::right, hex0xupper(val), 18, '0'),
-		" SCORE=", width(scalar_placement::right, score, 12),
-		" RATE=", width(scalar_placement::right, rate, 10),
-		" NAME=", left(name, 16, '.'));
-}
+using bench::make_record_fastio;
 
 #if defined(ENABLE_STD_FORMAT_BENCH)
 inline std::string make_record_stdformat(std::uint32_t i)
 {
-	std::uint32_t id = i * 2654435761u + 0x9e3779b9u;
-	std::uint64_t val = 0xDEADBEEFCAFEBABEull ^ static_cast<std::uint64_t>(id) * 1315423911ull;
-	std::uint32_t score = (id % 10007) + 3141;
-	std::uint32_t rate = score / ((id % 97) + 1);
+	auto const [id, val, score, rate] = bench::make_log_record_fields(i);
 	constexpr auto name = "fastio";
 	return std::format("ID={:#010X} VAL={:#018X} SCORE={:>12} RATE={:>10} NAME={:.<16}",
 					   id, val, score, rate, name);
@@ -109,10 +89,7 @@ inline std::string make_record_stdformat(std::uint32_t i)
 #if __has_include(<fmt/core.h>) && defined(ENABLE_FMT_BENCH)
 inline std::string make_record_fmt(std::uint32_t i)
 {
-	std::uint32_t id = i * 2654435761u + 0x9e3779b9u;
-	std::uint64_t val = 0xDEADBEEFCAFEBABEull ^ static_cast<std::uint64_t>(id) * 1315423911ull;
-	std::uint32_t score = (id % 10007) + 3141;
-	std::uint32_t rate = score / ((id % 97) + 1);
+	auto const [id, val, score, rate] = bench::make_log_record_fields(i);
 	constexpr auto name = "fastio";
 
 #if __has_include(<fmt/compile.h>)
@@ -128,10 +105,7 @@ inline std::string make_record_fmt(std::uint32_t i)
 // iostream 
 inline std::string make_record_iostream(std::uint32_t i)
 {
-	std::uint32_t id = i * 2654435761u + 0x9e3779b9u;
-	std::uint64_t val = 0xDEADBEEFCAFEBABEull ^ static_cast<std::uint64_t>(id) * 1315423911ull;
-	std::uint32_t score = (id % 10007) + 3141;
-	std::uint32_t rate = score / ((id % 97) + 1);
+	auto const [id, val, score, rate] = bench::make_log_record_fields(i);
 	constexpr char const *name = "fastio";
 
 	std::ostringstream oss;
@@ -279,6 +253,83 @@ inline benchmark_result run_write_bench_iostream(std::uint32_t iterations, bool
 	return {total_size, end - start};
 }
 
+#if __has_include(<fmt/core.h>) && defined(ENABLE_FMT_BENCH)
+// Formats every record straight into `buf`, one output buffer sized for the
+// whole run, then issues a single write to /dev/null. No per-record string is
+// built, so the output buffer's pages are not hidden behind heap allocation.
+inline benchmark_result run_write_bench_whole_run(std::uint32_t iterations, char *buf, std::size_t capacity)
+{
+	std::size_t total_size{};
+	auto start = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	{
+		fast_io::native_file nf("/dev/null", fast_io::open_mode::out | fast_io::open_mode::trunc);
+		std::size_t pos{};
+		for (std::uint32_t i{}; i != iterations; ++i)
+		{
+			auto const [id, val, score, rate] = bench::make_log_record_fields(i);
+			constexpr auto name = "fastio";
+			for (;;)
+			{
+				std::size_t const room = capacity - pos > 1 ? capacity - pos - 1 : 0; // keep one byte for '\n'
+				auto res = fmt::format_to_n(buf + pos, room,
+											FMT_COMPILE("ID={:#010X} VAL={:#018X} SCORE={:>12} RATE={:>10} NAME={:.<16}"),
+											id, val, score, rate, name);
+				if (res.size <= room)
+				{
+					pos += res.size;
+					total_size += res.size;
+					break;
+				}
+				// Only reached if a record outgrows record 0; capacity covers the rest.
+				::fast_io::operations::write_all(nf, buf, buf + pos);
+				pos = 0;
+			}
+			buf[pos++] = '\n';
+		}
+		::fast_io::operations::write_all(nf, buf, buf + pos);
+	}
+	auto end = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	return {total_size, end - start};
+}
+
+// Runs the whole-run write bench with its buffer placed per `mode` and returns
+// the best of `rounds`. "default" takes the buffer from the default allocator,
+// so page size is the only variable between modes.
+inline bench::mode_timings run_write_bench_whole_run_page_mode(std::uint32_t iterations, std::uint32_t rounds, bench::page_mode mode)
+{
+	std::size_t const capacity = static_cast<std::size_t>(iterations) * (make_record_fmt(0).size() + 1) + 1;
+	std::unique_ptr<bench::page_arena> arena;
+	if (mode != bench::page_mode::heap)
+	{
+		arena = std::make_unique<bench::page_arena>(capacity, mode);
+	}
+	bench::arena_allocator<char> alloc{arena.get()};
+	char *buf = alloc.allocate(capacity);
+	if (!arena)
+	{
+		// The arena is pre-faulted; fault the heap buffer too so both modes start warm.
+		for (std::size_t off{}; off < capacity; off += bench::small_page_size)
+		{
+			buf[off] = 0;
+		}
+	}
+	std::size_t total_size{};
+	auto best = bench::best_of_rounds(rounds, [&] {
+		total_size = run_write_bench_whole_run(iterations, buf, capacity).total_size;
+		return static_cast<std::uint64_t>(total_size);
+	});
+	alloc.deallocate(buf, capacity);
+	bench::mode_timings r{mode, arena ? arena->mode() : mode, {bench::to_seconds(best)}};
+	bench::print_page_mode(r.requested, r.effective);
+	print(" fmt format_to whole-run buf (size: ", total_size, ") best of ", rounds, " took ", best, "s\n");
+	return r;
+}
+#endif
+
+// usage: format_vs_fmt [iterations] [rounds] [default|4k|thp|hugetlb|compare]
+// The page mode argument (see page_compare.h) enables the whole-run output
+// buffer bench, which needs about iterations * 94 bytes (~940 MB at the
+// default iterations).
 int main(int argc, char **argv)
 {
 	std::uint32_t iterations = 10000000;
@@ -305,6 +356,11 @@ int main(int argc, char **argv)
 			// ignore invalid input, keep default ROUNDS
 		}
 	}
+	bench::page_mode_arg page_mode_arg;
+	if (argc >= 4 && !bench::parse_page_mode_arg(argv[3], page_mode_arg))
+	{
+		return 1;
+	}
 
 	auto sample_fastio = make_record_fastio(1);
 #if defined(ENABLE_STD_FORMAT_BENCH)
@@ -406,4 +462,24 @@ int main(int argc, char **argv)
 		print("fmt(FMT_COMPILE)+no  (size: ", fmt_nobuf.total_size, ") took ", fmt_nobuf.elapsed, "s\n");
 	}
 #endif
+
+#if __has_include(<fmt/core.h>) && defined(ENABLE_FMT_BENCH)
+	if (argc < 4)
+	{
+		return 0;
+	}
+	print("\n\n[whole-run output buffer]\n");
+	if (!page_mode_arg.compare)
+	{
+		run_write_bench_whole_run_page_mode(iterations, rounds, page_mode_arg.mode);
+		return 0;
+	}
+	std::vector<bench::mode_timings> results;
+	for (auto mode : bench::compare_modes)
+	{
+		results.push_back(run_write_bench_whole_run_page_mode(iterations, rounds, mode));
+	}
+	constexpr std::string_view names[]{"fmt format_to whole-run buf"};
+	bench::print_delta_report(names, results);
+#endif
 }
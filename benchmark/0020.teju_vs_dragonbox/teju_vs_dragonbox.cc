@@ -4,22 +4,38 @@
 #include <vector>
 #include <limits>
 #include <cstring>
-#include <fast_io_driver/timer.h>
+#include <memory>
+#include <string_view>
 #include <fast_io_unit/floating/roundtrip.h>
 #include <fast_io_unit/floating/punning.h>
 #include <teju/float.h>
 #include <teju/double.h>
 #include <dragonbox/dragonbox.h>
 #include <dragonbox/dragonbox_to_chars.h>
+#include <page_arena.h>
+#include <page_compare.h>
 
 using namespace fast_io::io;
 
+// Best of `rounds` runs of one formatter loop, printed like fast_io::timer.
+template <typename F>
+static double time_formatter(std::string_view name, std::uint32_t rounds, F f)
+{
+	auto elapsed = bench::best_of_rounds(rounds, f);
+	print(name, ": ", elapsed, "s\n");
+	return bench::to_seconds(elapsed);
+}
+
+template <class T>
+using value_vector = std::vector<T, bench::arena_allocator<T>>;
+
+// arena == nullptr keeps the default allocator.
 template <class T>
-static std::vector<T> make_random_values(std::size_t n)
+static value_vector<T> make_random_values(std::size_t n, bench::page_arena *arena)
 {
 	std::mt19937_64 eng{123456789u};
 	std::uniform_real_distribution<T> dist(std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max());
-	std::vector<T> v;
+	value_vector<T> v{bench::arena_allocator<T>{arena}};
 	v.reserve(n);
 	for (std::size_t i = 0; i < n; ++i)
 	{
@@ -28,9 +44,9 @@ static std::vector<T> make_random_values(std::size_t n)
 	return v;
 }
 
-static void bench_float(std::size_t n)
+static void bench_float(std::size_t n, bench::page_arena *arena, std::uint32_t rounds, std::vector<double> &seconds)
 {
-	auto values = make_random_values<float>(n);
+	auto values = make_random_values<float>(n, arena);
 
 	if(!values.empty())
 	{
@@ -47,8 +63,7 @@ static void bench_float(std::size_t n)
 			" teju=", fast_io::mnp::strvw(teju_buf, teju_p));
 	}
 
-	{
-		fast_io::timer t(u8"fastio_float");
+	seconds.push_back(time_formatter("fastio_float", rounds, [&] {
 		std::uint64_t acc{};
 		for (auto const x : values)
 		{
@@ -60,13 +75,11 @@ static void bench_float(std::size_t n)
 			auto *p = fast_io::pr_rsv_to_c_array(buf, fast_io::mnp::scientific(x));
 			acc += static_cast<std::uint64_t>(p - buf);
 		}
-		std::uint64_t volatile sink = acc;
-		(void)sink;
-	}
+		return acc;
+	}));
 
-	{
+	seconds.push_back(time_formatter("dragonbox_float", rounds, [&] {
 		using namespace jkj::dragonbox;
-		fast_io::timer t(u8"dragonbox_float");
 		std::uint64_t acc{};
 		for (auto const x : values)
 		{
@@ -74,12 +87,10 @@ static void bench_float(std::size_t n)
 			auto *p = to_chars(x, buf);
 			acc += static_cast<std::uint64_t>(p - buf);
 		}
-		std::uint64_t volatile sink = acc;
-		(void)sink;
-	}
+		return acc;
+	}));
 
-	{
-		fast_io::timer t(u8"teju_float");
+	seconds.push_back(time_formatter("teju_float", rounds, [&] {
 		std::uint64_t acc{};
 		for (auto const x : values)
 		{
@@ -87,14 +98,13 @@ static void bench_float(std::size_t n)
 			auto *p = jkj::dragonbox::to_chars(x, buf);
 			acc += static_cast<std::uint64_t>(p - buf);
 		}
-		std::uint64_t volatile sink = acc;
-		(void)sink;
-	}
+		return acc;
+	}));
 }
 
-static void bench_double(std::size_t n)
+static void bench_double(std::size_t n, bench::page_arena *arena, std::uint32_t rounds, std::vector<double> &seconds)
 {
-	auto values = make_random_values<double>(n);
+	auto values = make_random_values<double>(n, arena);
 
 	if(!values.empty())
 	{
@@ -111,9 +121,8 @@ static void bench_double(std::size_t n)
 			" teju=", fast_io::mnp::strvw(teju_buf, teju_p));
 	}
 
-	{
-		// fast_io core (dragonbox_impl only, no string assembly)
-		fast_io::timer t(u8"fastio_double");
+	// fast_io core (dragonbox_impl only, no string assembly)
+	seconds.push_back(time_formatter("fastio_double", rounds, [&] {
 		std::uint64_t acc{};
 		for (auto const x : values)
 		{
@@ -121,13 +130,11 @@ static void bench_double(std::size_t n)
 			auto *p = fast_io::pr_rsv_to_c_array(buf, fast_io::mnp::scientific(x));
 			acc += static_cast<std::uint64_t>(p - buf);
 		}
-		std::uint64_t volatile sink = acc;
-		(void)sink;
-	}
+		return acc;
+	}));
 
-	{
+	seconds.push_back(time_formatter("dragonbox_double", rounds, [&] {
 		using namespace jkj::dragonbox;
-		fast_io::timer t(u8"dragonbox_double");
 		std::uint64_t acc{};
 		for (auto const x : values)
 		{
@@ -135,12 +142,10 @@ static void bench_double(std::size_t n)
 			auto *p = to_chars(x, buf);
 			acc += static_cast<std::uint64_t>(p - buf);
 		}
-		std::uint64_t volatile sink = acc;
-		(void)sink;
-	}
+		return acc;
+	}));
 
-	{
-		fast_io::timer t(u8"teju_double");
+	seconds.push_back(time_formatter("teju_double", rounds, [&] {
 		std::uint64_t acc{};
 		for (auto const x : values)
 		{
@@ -148,15 +153,57 @@ static void bench_double(std::size_t n)
 			auto *p = jkj::dragonbox::to_chars(x, buf);
 			acc += static_cast<std::uint64_t>(p - buf);
 		}
-		std::uint64_t volatile sink = acc;
-		(void)sink;
+		return acc;
+	}));
+}
+
+// Rows in the order bench_float then bench_double time them.
+inline constexpr std::string_view formatter_names[]{
+	"fastio_float", "dragonbox_float", "teju_float",
+	"fastio_double", "dragonbox_double", "teju_double",
+};
+
+static bench::mode_timings run_mode(bench::page_mode mode, std::size_t n, std::uint32_t rounds)
+{
+	std::unique_ptr<bench::page_arena> arena;
+	if (mode != bench::page_mode::heap)
+	{
+		// float and double values live side by side; leave slack for alignment.
+		arena = std::make_unique<bench::page_arena>(n * (sizeof(float) + sizeof(double)) + 64, mode);
 	}
+	bench::mode_timings r{mode, arena ? arena->mode() : mode, {}};
+	bench::print_page_mode(r.requested, r.effective);
+	print(" best of ", rounds, " rounds\n");
+	bench_float(n, arena.get(), rounds, r.seconds);
+	print("\n");
+	bench_double(n, arena.get(), rounds, r.seconds);
+	return r;
 }
 
-int main()
+// usage: teju_vs_dragonbox [default|4k|thp|hugetlb|compare] [rounds]
+// See page_compare.h for the page modes.
+int main(int argc, char **argv)
 {
 	constexpr std::size_t N = 1u << 20; // ~1M samples
-	bench_float(N);
-	print("\n");
-	bench_double(N);
+	constexpr std::uint32_t default_rounds = 5;
+
+	bench::page_mode_arg mode_arg;
+	if (!bench::parse_page_mode_arg(argc >= 2 ? std::string_view(argv[1]) : std::string_view(), mode_arg))
+	{
+		return 1;
+	}
+	std::uint32_t const rounds = argc >= 3 ? bench::parse_rounds_arg(argv[2], default_rounds) : default_rounds;
+	if (!mode_arg.compare)
+	{
+		run_mode(mode_arg.mode, N, rounds);
+		return 0;
+	}
+
+	std::vector<bench::mode_timings> results;
+	for (auto mode : bench::compare_modes)
+	{
+		results.push_back(run_mode(mode, N, rounds));
+		print("\n");
+	}
+	bench::print_delta_report(formatter_names, results);
 }
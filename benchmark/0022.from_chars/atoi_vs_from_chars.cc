@@ -1,37 +1,191 @@
 #include <fast_io.h>
 #include <fast_io_device.h>
-#include <fast_io_driver/timer.h>
 #include <vector>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <cstring>
+#include <random>
 #include <fast_io_dsal/string.h>
 #include <charconv>
 #include <fast_float/fast_float.h>
+#include <page_arena.h>
+#include <page_compare.h>
+#include <log_record.h>
+#include <checked_from_chars.h>
 
 using namespace fast_io::io;
 
-static std::string make_numbers_buffer(std::size_t n)
+inline constexpr std::size_t max_line_size(std::size_t n)
+{
+	std::size_t digits{1};
+	for (std::size_t v = (n == 0 ? 0 : n - 1); v >= 10; v /= 10)
+	{
+		++digits;
+	}
+	return digits + 1; // '\n'
+}
+
+// Writes "0\n1\n...(n-1)\n" into [first, last) in one pass and returns the end.
+static char *make_numbers_buffer(char *first, char *last, std::size_t n)
 {
-	std::string s;
-	s.reserve(n * 8);
 	for (std::size_t i{}; i != n; ++i)
 	{
-		auto old = s.size();
-		s.resize(old + 32);
-		auto *first = s.data() + old;
-		auto *last = s.data() + s.size();
 		auto res = std::to_chars(first, last - 1, i);
 		*res.ptr = '\n';
-		s.resize(res.ptr - s.data() + 1);
+		first = res.ptr + 1;
 	}
-	return s;
+	return first;
 }
 
-int main()
+static std::uint64_t parse_atoi(char const *begin, char const *end)
 {
-	constexpr std::size_t N = 10'000'000;
-	auto buf = make_numbers_buffer(N);
-	char const *begin = buf.data();
-	char const *end = buf.data() + buf.size();
+	std::uint64_t sum{};
+	char const *p = begin;
+	while (p < end)
+	{
+		int v = std::atoi(p);
+		sum += static_cast<std::uint64_t>(v);
+		while (p < end && *p >= '0' && *p <= '9')
+		{
+			++p;
+		}
+		if (p < end && *p == '\n')
+		{
+			++p;
+		}
+	}
+	return sum;
+}
+
+static std::uint64_t parse_std_from_chars(char const *begin, char const *end)
+{
+	std::uint64_t sum{};
+	char const *p = begin;
+	while (p < end)
+	{
+		std::uint64_t v{};
+		auto res = std::from_chars(p, end, v);
+		sum += v;
+		p = res.ptr;
+		if (p < end && *p == '\n')
+		{
+			++p;
+		}
+	}
+	return sum;
+}
+
+static std::uint64_t parse_fastio_char_digit_to_literal(char const *begin, char const *end)
+{
+	std::uint64_t sum{};
+	char const *p = begin;
+	while (p < end)
+	{
+		using UCh = std::make_unsigned_t<char>;
+		std::uint64_t v{};
+		char const *q = p;
+		while (q < end && *q != '\n')
+		{
+			UCh ch = static_cast<UCh>(*q);
+			if (fast_io::details::char_digit_to_literal<10, char>(ch))
+			{
+				break;
+			}
+			v = v * 10 + static_cast<std::uint64_t>(ch);
+			++q;
+		}
+		sum += v;
+		p = (q < end ? q + 1 : q);
+	}
+	return sum;
+}
+
+static std::uint64_t parse_fast_float(char const *begin, char const *end)
+{
+	std::uint64_t sum{};
+	char const *p = begin;
+	while (p < end)
+	{
+		std::uint64_t v{};
+		auto res = fast_float::from_chars(p, end, v);
+		sum += v;
+		p = res.ptr;
+		if (p < end && *p == '\n')
+		{
+			++p;
+		}
+	}
+	return sum;
+}
+
+struct parser_entry
+{
+	std::string_view name;
+	std::uint64_t (*parse)(char const *, char const *);
+};
+
+inline constexpr parser_entry parsers[]{
+	{"atoi", parse_atoi},
+	{"std_from_chars", parse_std_from_chars},
+	{"fastio_char_digit_to_literal", parse_fastio_char_digit_to_literal},
+	{"fast_float_from_chars", parse_fast_float},
+};
+
+inline constexpr std::size_t parser_count = sizeof(parsers) / sizeof(parsers[0]);
+
+// Input storage for one page mode: a std::string for "default", the arena otherwise.
+// `first` points into `heap` or the arena, so the buffer is built in place and
+// never copied or moved.
+struct input_buffer
+{
+	std::string heap;
+	std::unique_ptr<bench::page_arena> arena;
+	char *first{};
+	std::size_t capacity{};
+	bench::page_mode mode{};
+
+	input_buffer(bench::page_mode m, std::size_t cap) : capacity(cap), mode(m)
+	{
+		if (mode == bench::page_mode::heap)
+		{
+			heap.resize(capacity);
+			first = heap.data();
+		}
+		else
+		{
+			arena = std::make_unique<bench::page_arena>(capacity, mode);
+			first = static_cast<char *>(arena->allocate(capacity, 1));
+		}
+	}
+
+	input_buffer(input_buffer const &) = delete;
+	input_buffer &operator=(input_buffer const &) = delete;
+
+	// The mode the pages really have: hugetlb falls back to thp when refused.
+	bench::page_mode effective_mode() const noexcept
+	{
+		return arena ? arena->mode() : mode;
+	}
+};
+
+static void print_page_mode(input_buffer const &b)
+{
+	bench::print_page_mode(b.mode, b.effective_mode());
+}
+
+static bench::mode_timings run_mode(bench::page_mode mode, std::size_t n, std::uint32_t rounds)
+{
+	input_buffer buf(mode, n * max_line_size(n) + 1); // trailing NUL for atoi
+	char *last = make_numbers_buffer(buf.first, buf.first + buf.capacity, n);
+	*last = '\0';
+	char const *begin = buf.first;
+	char const *end = last;
+	std::size_t const bytes = static_cast<std::size_t>(end - begin);
+
+	bench::mode_timings r{mode, buf.effective_mode(), {}};
+	print_page_mode(buf);
+	print(" input=", bytes, " bytes, best of ", rounds, " rounds\n");
 
 	{
 		std::size_t lines{};
@@ -42,94 +196,524 @@ int main()
 		fast_io::println("lines=", lines);
 	}
 
-	// atoi
+	for (auto const &parser : parsers)
+	{
+		auto elapsed = bench::best_of_rounds(rounds, [&] { return parser.parse(begin, end); });
+		double const seconds = bench::to_seconds(elapsed);
+		r.seconds.push_back(seconds);
+		double const mbps = seconds > 0 ? static_cast<double>(bytes) / seconds / 1e6 : 0;
+		print(parser.name, ": ", elapsed, "s (", bench::round2(mbps), " MB/s)\n");
+	}
+	return r;
+}
+
+// ---- checked parsing: every parser below reports overflow and bad input ----
+
+enum class checked_input
+{
+	valid_u64,
+	valid_i64,
+	adversarial
+};
+
+inline constexpr std::string_view checked_input_name(checked_input k) noexcept
+{
+	switch (k)
 	{
-		fast_io::timer t(u8"atoi");
-		std::uint64_t sum{};
-		char const *p = begin;
-		while (p < end)
+	case checked_input::valid_u64:
+		return "valid u64";
+	case checked_input::valid_i64:
+		return "valid i64";
+	default:
+		return "adversarial";
+	}
+}
+
+// Hostile lines for a u64/i64 field: overflow just past each limit, long
+// overflow, leading zeros, trailing garbage, bare sign, empty line, and the
+// exact limits which must still be accepted.
+inline constexpr std::string_view adversarial_lines[]{
+	"18446744073709551616",
+	"99999999999999999999999999",
+	"9223372036854775808",
+	"-9223372036854775809",
+	"000000000000000000000000000000000042",
+	"1234567x89",
+	"-",
+	"",
+	"+17",
+	" 17",
+	"18446744073709551615",
+	"-9223372036854775808",
+};
+
+// One value per line; the valid sets mix every length from 1 to 19/20 digits.
+static char *make_checked_buffer(char *first, char *last, std::size_t n, checked_input kind)
+{
+	std::mt19937_64 eng{20240611u};
+	constexpr std::size_t adversarial_count = sizeof(adversarial_lines) / sizeof(adversarial_lines[0]);
+	for (std::size_t i{}; i != n; ++i)
+	{
+		std::uint64_t const r = eng();
+		std::uint64_t const bits = r >> (eng() % 64);
+		if (kind == checked_input::valid_u64)
 		{
-			int v = std::atoi(p);
-			sum += static_cast<std::uint64_t>(v);
-			while (p < end && *p >= '0' && *p <= '9')
-			{
-				++p;
-			}
-			if (p < end && *p == '\n')
-			{
-				++p;
-			}
+			first = std::to_chars(first, last, bits).ptr;
 		}
-		std::uint64_t volatile sink = sum;
-		(void)sink;
+		else if (kind == checked_input::valid_i64)
+		{
+			auto const v = static_cast<std::int64_t>(bits >> 1);
+			first = std::to_chars(first, last, (r & 1) ? -v : v).ptr;
+		}
+		else
+		{
+			// Random order, so branch predictors cannot learn a fixed cycle.
+			auto const line = adversarial_lines[r % adversarial_count];
+			std::memcpy(first, line.data(), line.size());
+			first += line.size();
+		}
+		*first++ = '\n';
 	}
+	return first;
+}
+
+struct checked_stats
+{
+	std::size_t ok{};
+	std::size_t errors{};
+	std::uint64_t sum{};
+	fast_io::unix_timestamp elapsed{};
+};
 
-	// std::from_chars
+// A line counts as ok only if the parser succeeds and stops on its '\n'.
+template <typename T, typename Parse>
+static checked_stats run_checked(char const *begin, char const *end, Parse parse)
+{
+	checked_stats st;
+	auto start = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	char const *p = begin;
+	while (p < end)
 	{
-		fast_io::timer t(u8"std_from_chars");
-		std::uint64_t sum{};
-		char const *p = begin;
-		while (p < end)
+		T v{};
+		auto res = parse(p, end, v);
+		if (res.ec == std::errc{} && res.ptr != end && *res.ptr == '\n')
 		{
-			std::uint64_t v{};
-			auto res = std::from_chars(p, end, v);
-			sum += v;
-			p = res.ptr;
-			if (p < end && *p == '\n')
-			{
-				++p;
-			}
+			++st.ok;
+			st.sum += static_cast<std::uint64_t>(v);
+			p = res.ptr + 1;
+		}
+		else
+		{
+			++st.errors;
+			auto const *nl = static_cast<char const *>(std::memchr(res.ptr, '\n', static_cast<std::size_t>(end - res.ptr)));
+			p = nl ? nl + 1 : end;
+		}
+	}
+	auto stop = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	st.elapsed = stop - start;
+	return st;
+}
+
+template <typename T>
+static void run_checked_parsers(char const *begin, char const *end)
+{
+	std::size_t const bytes = static_cast<std::size_t>(end - begin);
+	checked_stats const results[]{
+		run_checked<T>(begin, end, [](char const *f, char const *l, T &v) { return bench::checked_from_chars(f, l, v); }),
+		run_checked<T>(begin, end, [](char const *f, char const *l, T &v) { return std::from_chars(f, l, v); }),
+		run_checked<T>(begin, end, [](char const *f, char const *l, T &v) { return fast_float::from_chars(f, l, v); }),
+	};
+	constexpr std::string_view names[]{"checked_swar", "std_from_chars", "fast_float_from_chars"};
+	for (std::size_t i{}; i != sizeof(results) / sizeof(results[0]); ++i)
+	{
+		auto const &st = results[i];
+		double const seconds = bench::to_seconds(st.elapsed);
+		double const mbps = seconds > 0 ? static_cast<double>(bytes) / seconds / 1e6 : 0;
+		print("  ", names[i], ": ", st.elapsed, "s (", bench::round2(mbps), " MB/s) ok=", st.ok, " errors=", st.errors);
+		if (st.ok != results[0].ok || st.errors != results[0].errors || st.sum != results[0].sum)
+		{
+			print(" MISMATCH vs checked_swar");
 		}
-		std::uint64_t volatile sink = sum;
-		(void)sink;
+		print("\n");
+	}
+}
+
+static void run_checked_mode(bench::page_mode mode, std::size_t n)
+{
+	for (auto kind : {checked_input::valid_u64, checked_input::valid_i64, checked_input::adversarial})
+	{
+		// 20 digits, sign and '\n' bound every generated and adversarial line
+		// except the long-overflow one, which is still under 40 bytes.
+		input_buffer buf(mode, n * 40);
+		char const *end = make_checked_buffer(buf.first, buf.first + buf.capacity, n, kind);
+		print_page_mode(buf);
+		print(" checked ", checked_input_name(kind), " input=", static_cast<std::size_t>(end - buf.first), " bytes\n");
+		print(" as u64:\n");
+		run_checked_parsers<std::uint64_t>(buf.first, end);
+		print(" as i64:\n");
+		run_checked_parsers<std::int64_t>(buf.first, end);
+	}
+}
+
+// ---- base 16/8/2 parsing and the 0019 log record roundtrip ----
+
+enum class radix_input
+{
+	hex_0x,
+	hex,
+	octal,
+	binary
+};
+
+inline constexpr unsigned radix_base(radix_input k) noexcept
+{
+	switch (k)
+	{
+	case radix_input::octal:
+		return 8;
+	case radix_input::binary:
+		return 2;
+	default:
+		return 16;
+	}
+}
+
+inline constexpr std::string_view radix_input_name(radix_input k) noexcept
+{
+	switch (k)
+	{
+	case radix_input::hex_0x:
+		return "hex 0x-prefixed mixed case";
+	case radix_input::hex:
+		return "hex mixed case";
+	case radix_input::octal:
+		return "octal";
+	default:
+		return "binary";
 	}
+}
 
+// Widest line per input kind: 64 binary digits, plus '\n'.
+inline constexpr std::size_t radix_max_line_size = 65;
 
-	// fast_io char_digit_to_literal
+static char *make_radix_buffer(char *first, char *last, std::size_t n, radix_input kind)
+{
+	std::mt19937_64 eng{20240612u};
+	for (std::size_t i{}; i != n; ++i)
 	{
-		fast_io::timer t(u8"fastio_char_digit_to_literal");
-		std::uint64_t sum{};
-		char const *p = begin;
-		while (p < end)
+		std::uint64_t const v = eng() >> (eng() % 64);
+		if (kind == radix_input::hex_0x)
 		{
-			using UCh = std::make_unsigned_t<char>;
-			std::uint64_t v{};
-			char const *q = p;
-			while (q < end && *q != '\n')
+			*first++ = '0';
+			*first++ = (eng() & 1) ? 'X' : 'x';
+		}
+		char *digits = first;
+		first = std::to_chars(first, last, v, static_cast<int>(radix_base(kind))).ptr;
+		if (radix_base(kind) == 16)
+		{
+			std::uint64_t upper = eng();
+			for (char *q = digits; q != first; ++q, upper >>= 1)
 			{
-				UCh ch = static_cast<UCh>(*q);
-				if (fast_io::details::char_digit_to_literal<10, char>(ch))
+				if (*q >= 'a' && (upper & 1))
 				{
-					break;
+					*q = static_cast<char>(*q - 'a' + 'A');
 				}
-				v = v * 10 + static_cast<std::uint64_t>(ch);
-				++q;
 			}
-			sum += v;
-			p = (q < end ? q + 1 : q);
 		}
-		std::uint64_t volatile sink = sum;
-		(void)sink;
+		*first++ = '\n';
 	}
+	return first;
+}
 
-	// fast_float
+inline char const *skip_0x(char const *p, char const *end) noexcept
+{
+	if (end - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
 	{
-		fast_io::timer t(u8"fast_float_from_chars");
-		std::uint64_t sum{};
-		char const *p = begin;
-		while (p < end)
+		return p + 2;
+	}
+	return p;
+}
+
+// Each parser reads digits only (no prefix) and returns the end of the digits,
+// or nullptr if there were none.
+template <unsigned base>
+inline char const *radix_parse_fastio(char const *first, char const *last, std::uint64_t &v) noexcept
+{
+	using UCh = std::make_unsigned_t<char>;
+	std::uint64_t r{};
+	char const *q = first;
+	for (; q != last; ++q)
+	{
+		UCh ch = static_cast<UCh>(*q);
+		if (fast_io::details::char_digit_to_literal<base, char>(ch))
 		{
-			std::uint64_t v{};
-			auto res = fast_float::from_chars(p, end, v);
-			sum += v;
-			p = res.ptr;
-			if (p < end && *p == '\n')
-			{
-				++p;
-			}
+			break;
+		}
+		r = r * base + static_cast<std::uint64_t>(ch);
+	}
+	v = r;
+	return q == first ? nullptr : q;
+}
+
+template <unsigned base>
+inline char const *radix_parse_std_from_chars(char const *first, char const *last, std::uint64_t &v) noexcept
+{
+	auto res = std::from_chars(first, last, v, static_cast<int>(base));
+	return res.ec == std::errc{} ? res.ptr : nullptr;
+}
+
+template <unsigned base>
+inline char const *radix_parse_fast_float(char const *first, char const *last, std::uint64_t &v) noexcept
+{
+	auto res = fast_float::from_chars(first, last, v, static_cast<int>(base));
+	return res.ec == std::errc{} ? res.ptr : nullptr;
+}
+
+// strtoull stops at the '\n' or ' ' after the field; the buffers are NUL-terminated.
+template <unsigned base>
+inline char const *radix_parse_strtoull(char const *first, char const *, std::uint64_t &v) noexcept
+{
+	char *e;
+	v = std::strtoull(first, &e, static_cast<int>(base));
+	return e == first ? nullptr : e;
+}
+
+using radix_parse_fn = char const *(*)(char const *, char const *, std::uint64_t &) noexcept;
+
+struct radix_parser_entry
+{
+	std::string_view name;
+	radix_parse_fn parse[3]; // base 16, 8, 2
+};
+
+inline constexpr radix_parser_entry radix_parsers[]{
+	{"fastio_char_digit_to_literal", {radix_parse_fastio<16>, radix_parse_fastio<8>, radix_parse_fastio<2>}},
+	{"std_from_chars", {radix_parse_std_from_chars<16>, radix_parse_std_from_chars<8>, radix_parse_std_from_chars<2>}},
+	{"fast_float_from_chars", {radix_parse_fast_float<16>, radix_parse_fast_float<8>, radix_parse_fast_float<2>}},
+	{"strtoull", {radix_parse_strtoull<16>, radix_parse_strtoull<8>, radix_parse_strtoull<2>}},
+};
+
+inline constexpr std::size_t radix_parser_count = sizeof(radix_parsers) / sizeof(radix_parsers[0]);
+
+inline constexpr std::size_t radix_slot(unsigned base) noexcept
+{
+	return base == 16 ? 0 : (base == 8 ? 1 : 2);
+}
+
+static checked_stats run_radix_lines(char const *begin, char const *end, radix_parse_fn parse)
+{
+	checked_stats st;
+	auto start = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	char const *p = begin;
+	while (p < end)
+	{
+		std::uint64_t v{};
+		char const *q = parse(skip_0x(p, end), end, v);
+		if (q != nullptr && q != end && *q == '\n')
+		{
+			++st.ok;
+			st.sum += v;
+			p = q + 1;
+		}
+		else
+		{
+			++st.errors;
+			auto const *nl = static_cast<char const *>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+			p = nl ? nl + 1 : end;
 		}
-		std::uint64_t volatile sink = sum;
-		(void)sink;
 	}
+	auto stop = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	st.elapsed = stop - start;
+	return st;
+}
 
+// Hex digits of a 0019 field such as "0x0123ABCD"; fast_io pads in front of
+// the prefix ("000x123ABC"), so start after the 'x' wherever it is.
+inline char const *record_hex_digits(char const *field, char const *field_end) noexcept
+{
+	for (char const *q = field; q != field_end; ++q)
+	{
+		if (*q == 'x' || *q == 'X')
+		{
+			return q + 1;
+		}
+	}
+	return field;
+}
+
+// Where the ID and VAL hex digits of one record are, and what 0019 formatted
+// there. Built before timing so the roundtrip measures only the parsers.
+struct record_field_index
+{
+	char const *line{};
+	std::uint32_t id{};
+	std::uint64_t val{};
+	std::uint8_t id_first{}, id_last{}, val_first{}, val_last{};
+	bool valid{};
+};
+
+// Returns one entry per record; `digit_bytes` is the number of hex digit bytes
+// the parsers will read, which is what the roundtrip throughput is based on.
+static std::vector<record_field_index> index_records(char const *begin, char const *end, std::size_t &digit_bytes)
+{
+	constexpr std::string_view id_key{"ID="};
+	constexpr std::string_view val_key{" VAL="};
+	std::vector<record_field_index> records;
+	digit_bytes = 0;
+	char const *p = begin;
+	for (std::uint32_t i{}; p < end; ++i)
+	{
+		auto const *nl = static_cast<char const *>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+		char const *line_end = nl ? nl : end;
+		std::string_view const line(p, static_cast<std::size_t>(line_end - p));
+		auto const expected = bench::make_log_record_fields(i);
+		record_field_index r{p, expected.id, expected.val};
+		std::size_t const id_end = line.starts_with(id_key) ? line.find(' ', id_key.size()) : line.npos;
+		std::size_t const val_end = id_end == line.npos || !line.substr(id_end).starts_with(val_key)
+										? line.npos
+										: line.find(' ', id_end + val_key.size());
+		if (val_end != line.npos && val_end <= 0xFF)
+		{
+			r.id_first = static_cast<std::uint8_t>(record_hex_digits(p + id_key.size(), p + id_end) - p);
+			r.id_last = static_cast<std::uint8_t>(id_end);
+			r.val_first = static_cast<std::uint8_t>(record_hex_digits(p + id_end + val_key.size(), p + val_end) - p);
+			r.val_last = static_cast<std::uint8_t>(val_end);
+			r.valid = true;
+			digit_bytes += static_cast<std::size_t>(r.id_last - r.id_first) + (r.val_last - r.val_first);
+		}
+		records.push_back(r);
+		p = line_end + 1;
+	}
+	return records;
+}
+
+// Parses the ID and VAL fields of every record back and compares them with
+// the values 0019 formatted. ok counts records whose both fields roundtrip.
+static checked_stats run_record_roundtrip(std::vector<record_field_index> const &records, radix_parse_fn parse)
+{
+	checked_stats st;
+	auto start = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	for (auto const &r : records)
+	{
+		std::uint64_t id{}, val{};
+		bool const good = r.valid &&
+						  parse(r.line + r.id_first, r.line + r.id_last, id) == r.line + r.id_last &&
+						  parse(r.line + r.val_first, r.line + r.val_last, val) == r.line + r.val_last &&
+						  id == r.id && val == r.val;
+		if (good)
+		{
+			++st.ok;
+			st.sum += id ^ val;
+		}
+		else
+		{
+			++st.errors;
+		}
+	}
+	auto stop = fast_io::posix_clock_gettime(fast_io::posix_clock_id::monotonic_raw);
+	st.elapsed = stop - start;
+	return st;
+}
+
+template <typename Run>
+static void report_radix(std::size_t bytes, Run run)
+{
+	checked_stats results[radix_parser_count];
+	for (std::size_t i{}; i != radix_parser_count; ++i)
+	{
+		results[i] = run(radix_parsers[i]);
+	}
+	for (std::size_t i{}; i != radix_parser_count; ++i)
+	{
+		auto const &st = results[i];
+		double const seconds = bench::to_seconds(st.elapsed);
+		double const mbps = seconds > 0 ? static_cast<double>(bytes) / seconds / 1e6 : 0;
+		print("  ", radix_parsers[i].name, ": ", st.elapsed, "s (", bench::round2(mbps), " MB/s) ok=", st.ok, " errors=", st.errors);
+		if (st.ok != results[0].ok || st.errors != results[0].errors || st.sum != results[0].sum)
+		{
+			print(" MISMATCH vs ", radix_parsers[0].name);
+		}
+		print("\n");
+	}
+}
+
+static void run_radix_mode(bench::page_mode mode, std::size_t n)
+{
+	for (auto kind : {radix_input::hex_0x, radix_input::hex, radix_input::octal, radix_input::binary})
+	{
+		input_buffer buf(mode, n * (radix_max_line_size + 2) + 1);
+		char *end = make_radix_buffer(buf.first, buf.first + buf.capacity, n, kind);
+		*end = '\0';
+		std::size_t const bytes = static_cast<std::size_t>(end - buf.first);
+		print_page_mode(buf);
+		print(" base ", radix_base(kind), " ", radix_input_name(kind), " input=", bytes, " bytes\n");
+		std::size_t const slot = radix_slot(radix_base(kind));
+		report_radix(bytes, [&](radix_parser_entry const &e) { return run_radix_lines(buf.first, end, e.parse[slot]); });
+	}
+
+	// The records exactly as 0019 writes them, one per line. fast_io pads every
+	// field to a fixed width, so record 0 sizes the buffer; stop if one is longer.
+	std::size_t const record_size = bench::make_record_fastio(0).size() + 1;
+	input_buffer buf(mode, n * record_size + 1);
+	char *const fill_last = buf.first + buf.capacity - 1; // keep room for the NUL
+	char *end = buf.first;
+	for (std::size_t i{}; i != n; ++i)
+	{
+		auto rec = bench::make_record_fastio(static_cast<std::uint32_t>(i));
+		if (static_cast<std::size_t>(fill_last - end) < rec.size() + 1)
+		{
+			perr("0019 record ", i, " is longer than record 0; roundtrip input truncated\n");
+			break;
+		}
+		std::memcpy(end, rec.data(), rec.size());
+		end += rec.size();
+		*end++ = '\n';
+	}
+	*end = '\0';
+	std::size_t digit_bytes{};
+	auto const records = index_records(buf.first, end, digit_bytes);
+	print_page_mode(buf);
+	print(" 0019 record roundtrip (ID/VAL hex) input=", static_cast<std::size_t>(end - buf.first),
+		  " bytes, parsed=", digit_bytes, " bytes\n");
+	report_radix(digit_bytes, [&](radix_parser_entry const &e) { return run_record_roundtrip(records, e.parse[0]); });
+}
+
+// usage: atoi_vs_from_chars [default|4k|thp|hugetlb|compare] [rounds]
+// See page_compare.h for the page modes. Single modes also run the checked
+// u64/i64 parsers on valid and adversarial input, base 16/8/2 parsing, and a
+// parse-back of the 0019 log records.
+int main(int argc, char **argv)
+{
+	constexpr std::size_t N = 10'000'000;
+	constexpr std::uint32_t default_rounds = 5;
+
+	bench::page_mode_arg mode_arg;
+	if (!bench::parse_page_mode_arg(argc >= 2 ? std::string_view(argv[1]) : std::string_view(), mode_arg))
+	{
+		return 1;
+	}
+	std::uint32_t const rounds = argc >= 3 ? bench::parse_rounds_arg(argv[2], default_rounds) : default_rounds;
+	if (!mode_arg.compare)
+	{
+		run_mode(mode_arg.mode, N, rounds);
+		print("\n");
+		run_checked_mode(mode_arg.mode, N);
+		print("\n");
+		run_radix_mode(mode_arg.mode, N / 4);
+		return 0;
+	}
+
+	std::vector<bench::mode_timings> results;
+	for (auto mode : bench::compare_modes)
+	{
+		results.push_back(run_mode(mode, N, rounds));
+		print("\n");
+	}
+
+	std::string_view names[parser_count];
+	for (std::size_t i{}; i != parser_count; ++i)
+	{
+		names[i] = parsers[i].name;
+	}
+	bench::print_delta_report(names, results);
 }
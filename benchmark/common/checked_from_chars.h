@@ -0,0 +1,180 @@
+#pragma once
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+// Checked base-10 parsing for 64-bit integers, 8 digits per step (SWAR).
+//
+// Same contract as std::from_chars for base 10: an optional '-' for signed
+// types, then the longest run of digits; `value` is left untouched on error.
+// The one difference is the error position: on overflow `ptr` points at the
+// first digit that no longer fits instead of past the digit run, so callers
+// can report exactly where untrusted input went wrong.
+namespace bench
+{
+
+namespace details
+{
+
+inline constexpr std::uint64_t swar_ones = 0x0101010101010101ull;
+
+inline std::uint64_t load_u64(char const *p) noexcept
+{
+	std::uint64_t x;
+	std::memcpy(&x, p, sizeof(x));
+	if constexpr (std::endian::native == std::endian::big)
+	{
+		x = std::byteswap(x);
+	}
+	return x;
+}
+
+// Number of leading bytes of `x` (in memory order) that are '0'..'9'.
+// Byte-local arithmetic only: no carry can cross into the next byte.
+inline unsigned swar_digit_count(std::uint64_t x) noexcept
+{
+	std::uint64_t const low7 = x & (swar_ones * 0x7F);
+	std::uint64_t const above_nine = low7 + swar_ones * (0x80 - 0x3A);
+	std::uint64_t const at_least_zero = low7 + swar_ones * (0x80 - 0x30);
+	std::uint64_t const non_digit = (above_nine | ~at_least_zero | x) & (swar_ones * 0x80);
+	return non_digit == 0 ? 8u : static_cast<unsigned>(std::countr_zero(non_digit)) / 8u;
+}
+
+// Value of eight ASCII digits, first byte most significant.
+inline std::uint32_t swar_eight_digits(std::uint64_t x) noexcept
+{
+	x -= swar_ones * '0';
+	x = x * 10 + (x >> 8);
+	x = (((x & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+		 (((x >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >>
+		32;
+	return static_cast<std::uint32_t>(x);
+}
+
+inline constexpr std::uint64_t pow10_table[9]{1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+// v = v * mul + add, failing if the result would exceed `limit`.
+inline bool mul_add_checked(std::uint64_t &v, std::uint64_t mul, std::uint64_t add, std::uint64_t limit) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+	std::uint64_t r;
+	if (__builtin_mul_overflow(v, mul, &r) || __builtin_add_overflow(r, add, &r) || r > limit)
+	{
+		return false;
+	}
+	v = r;
+	return true;
+#else
+	if (add > limit || v > (limit - add) / mul)
+	{
+		return false;
+	}
+	v = v * mul + add;
+	return true;
+#endif
+}
+
+// Digits from `first` accumulated into `v` while the value stays <= limit.
+// Returns the end of the digit run, or sets `overflow` and returns the first
+// digit that did not fit. The caller guarantees at least one digit.
+inline char const *parse_magnitude(char const *first, char const *last, std::uint64_t &v,
+								   std::uint64_t limit, bool &overflow) noexcept
+{
+	std::uint64_t acc{};
+	char const *p = first;
+	while (last - p >= 8)
+	{
+		std::uint64_t const x = load_u64(p);
+		unsigned const k = swar_digit_count(x);
+		if (k == 0)
+		{
+			break;
+		}
+		// Pad the k leading digits on the left with '0's to reuse the 8-digit kernel.
+		std::uint64_t const padded = k == 8 ? x : (x << (8 * (8 - k))) | (swar_ones * '0' >> (8 * k));
+		std::uint64_t const chunk = swar_eight_digits(padded);
+		if (!mul_add_checked(acc, pow10_table[k], chunk, limit))
+		{
+			// Slow path, only on error: replay the chunk one digit at a time.
+			for (;; ++p)
+			{
+				if (!mul_add_checked(acc, 10, static_cast<std::uint64_t>(*p - '0'), limit))
+				{
+					overflow = true;
+					return p;
+				}
+			}
+		}
+		p += k;
+		if (k != 8)
+		{
+			v = acc;
+			return p;
+		}
+	}
+	for (; p != last; ++p)
+	{
+		std::uint64_t const d = static_cast<std::uint64_t>(static_cast<unsigned char>(*p)) - '0';
+		if (d > 9)
+		{
+			break;
+		}
+		if (!mul_add_checked(acc, 10, d, limit))
+		{
+			overflow = true;
+			return p;
+		}
+	}
+	v = acc;
+	return p;
+}
+
+} // namespace details
+
+template <typename T>
+	requires(std::is_same_v<T, std::uint64_t> || std::is_same_v<T, std::int64_t>)
+inline std::from_chars_result checked_from_chars(char const *first, char const *last, T &value) noexcept
+{
+	char const *p = first;
+	bool negative{};
+	if constexpr (std::is_signed_v<T>)
+	{
+		if (p != last && *p == '-')
+		{
+			negative = true;
+			++p;
+		}
+	}
+	if (p == last || static_cast<unsigned char>(*p - '0') > 9)
+	{
+		return {first, std::errc::invalid_argument};
+	}
+	std::uint64_t limit = std::numeric_limits<std::uint64_t>::max();
+	if constexpr (std::is_signed_v<T>)
+	{
+		limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) + (negative ? 1u : 0u);
+	}
+	std::uint64_t magnitude{};
+	bool overflow{};
+	p = details::parse_magnitude(p, last, magnitude, limit, overflow);
+	if (overflow)
+	{
+		return {p, std::errc::result_out_of_range};
+	}
+	if constexpr (std::is_signed_v<T>)
+	{
+		value = static_cast<T>(negative ? 0 - magnitude : magnitude);
+	}
+	else
+	{
+		value = magnitude;
+	}
+	return {p, std::errc{}};
+}
+
+} // namespace bench
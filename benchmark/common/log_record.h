@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <fast_io.h>
+#include <fast_io_dsal/string.h>
+
+// The log record benchmarked by 0019 and parsed back by 0022:
+// "ID=<hex0xupper, 10> VAL=<hex0xupper, 18> SCORE=<12> RATE=<10> NAME=<16>"
+// Every 0019 formatter takes its fields from make_log_record_fields.
+namespace bench
+{
+
+struct log_record_fields
+{
+	std::uint32_t id{};
+	std::uint64_t val{};
+	std::uint32_t score{};
+	std::uint32_t rate{};
+};
+
+inline constexpr log_record_fields make_log_record_fields(std::uint32_t i) noexcept
+{
+	std::uint32_t id = i * 2654435761u + 0x9e3779b9u;
+	std::uint64_t val = 0xDEADBEEFCAFEBABEull ^ (std::uint64_t)id * 1315423911ull;
+	std::uint32_t score = (id % 10007) + 3141;
+	std::uint32_t rate = score / ((id % 97) + 1);
+	return {id, val, score, rate};
+}
+
+inline ::fast_io::string make_record_fastio(std::uint32_t i)
+{
+	using namespace ::fast_io::mnp;
+	auto const [id, val, score, rate] = make_log_record_fields(i);
+	::fast_io::string name{"fastio"};
+
+	return fast_io::concat_fast_io(
+		"ID=", width(scalar_placement::right, hex0xupper(id), 10, '0'),
+		" VAL=", width(scalar_placement::right, hex0xupper(val), 18, '0'),
+		" SCORE=", width(scalar_placement::right, score, 12),
+		" RATE=", width(scalar_placement::right, rate, 10),
+		" NAME=", left(name, 16, '.'));
+}
+
+} // namespace bench
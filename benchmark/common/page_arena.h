@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string_view>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// Bump arena for benchmark input/output buffers.
+// Every page is faulted in up front so that the timed region only measures
+// TLB behaviour, never first-touch page faults.
+namespace bench
+{
+
+enum class page_mode
+{
+	heap,        // default allocator, no arena (the original behaviour)
+	small_pages, // arena on 4K pages, THP explicitly disabled
+	thp,         // arena with madvise(MADV_HUGEPAGE)
+	hugetlb      // arena with MAP_HUGETLB, falls back to thp if no huge pages are reserved
+};
+
+inline constexpr std::size_t small_page_size = 4096;
+inline constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+inline constexpr std::string_view page_mode_name(page_mode m) noexcept
+{
+	switch (m)
+	{
+	case page_mode::small_pages:
+		return "4k";
+	case page_mode::thp:
+		return "thp";
+	case page_mode::hugetlb:
+		return "hugetlb";
+	default:
+		return "default";
+	}
+}
+
+inline constexpr bool parse_page_mode(std::string_view s, page_mode &m) noexcept
+{
+	if (s == "default")
+	{
+		m = page_mode::heap;
+	}
+	else if (s == "4k")
+	{
+		m = page_mode::small_pages;
+	}
+	else if (s == "thp")
+	{
+		m = page_mode::thp;
+	}
+	else if (s == "hugetlb")
+	{
+		m = page_mode::hugetlb;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+class page_arena
+{
+public:
+	page_arena(std::size_t capacity, page_mode mode)
+	{
+		capacity_ = (capacity + huge_page_size - 1) / huge_page_size * huge_page_size;
+		if (capacity_ == 0)
+		{
+			capacity_ = huge_page_size;
+		}
+		mode_ = mode;
+#if defined(__linux__)
+		if (mode == page_mode::hugetlb)
+		{
+			void *p = ::mmap(nullptr, capacity_, PROT_READ | PROT_WRITE,
+							 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (p != MAP_FAILED)
+			{
+				map_base_ = p;
+				map_size_ = capacity_;
+				base_ = static_cast<std::byte *>(p);
+			}
+			else
+			{
+				// vm.nr_hugepages is usually 0; THP is the closest substitute.
+				mode_ = page_mode::thp;
+			}
+		}
+		if (base_ == nullptr)
+		{
+			// Over-map by one huge page so the arena can start on a 2M boundary,
+			// otherwise khugepaged cannot back the head and tail with huge pages.
+			map_size_ = capacity_ + huge_page_size;
+			void *p = ::mmap(nullptr, map_size_, PROT_READ | PROT_WRITE,
+							 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+			{
+				throw std::bad_alloc();
+			}
+			map_base_ = p;
+			auto addr = reinterpret_cast<std::uintptr_t>(p);
+			addr = (addr + huge_page_size - 1) & ~static_cast<std::uintptr_t>(huge_page_size - 1);
+			base_ = reinterpret_cast<std::byte *>(addr);
+#if defined(MADV_HUGEPAGE)
+			::madvise(base_, capacity_, mode_ == page_mode::thp ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+#endif
+		}
+#else
+		// No huge page control outside Linux; keep the arena on regular pages.
+		mode_ = page_mode::small_pages;
+		base_ = static_cast<std::byte *>(::operator new(capacity_, std::align_val_t{huge_page_size}));
+#endif
+		prefault();
+	}
+
+	page_arena(page_arena const &) = delete;
+	page_arena &operator=(page_arena const &) = delete;
+
+	~page_arena()
+	{
+#if defined(__linux__)
+		::munmap(map_base_, map_size_);
+#else
+		::operator delete(base_, std::align_val_t{huge_page_size});
+#endif
+	}
+
+	void *allocate(std::size_t n, std::size_t align)
+	{
+		std::size_t pos = (used_ + align - 1) & ~(align - 1);
+		if (pos > capacity_ || n > capacity_ - pos)
+		{
+			throw std::bad_alloc();
+		}
+		used_ = pos + n;
+		return base_ + pos;
+	}
+
+	// Effective mode: hugetlb degrades to thp when the mapping is refused.
+	page_mode mode() const noexcept
+	{
+		return mode_;
+	}
+
+	std::size_t capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	std::size_t used() const noexcept
+	{
+		return used_;
+	}
+
+private:
+	void prefault() noexcept
+	{
+		// Write, not read: a read fault on anonymous memory maps the shared zero page.
+		for (std::size_t off{}; off < capacity_; off += small_page_size)
+		{
+			*static_cast<std::byte volatile *>(base_ + off) = std::byte{};
+		}
+	}
+
+	std::byte *base_{};
+	std::size_t capacity_{};
+	std::size_t used_{};
+	void *map_base_{};
+	std::size_t map_size_{};
+	page_mode mode_{page_mode::heap};
+};
+
+// Allocator adaptor over page_arena. A null arena means the default allocator,
+// so the same container type serves every page mode. Deallocation into the
+// arena is a no-op; memory is released when the arena goes away.
+template <typename T>
+struct arena_allocator
+{
+	using value_type = T;
+
+	page_arena *arena{};
+
+	constexpr arena_allocator() noexcept = default;
+	constexpr explicit arena_allocator(page_arena *a) noexcept : arena(a)
+	{}
+	template <typename U>
+	constexpr arena_allocator(arena_allocator<U> const &other) noexcept : arena(other.arena)
+	{}
+
+	T *allocate(std::size_t n)
+	{
+		if (arena == nullptr)
+		{
+			return std::allocator<T>{}.allocate(n);
+		}
+		return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T *p, std::size_t n) noexcept
+	{
+		if (arena == nullptr)
+		{
+			std::allocator<T>{}.deallocate(p, n);
+		}
+	}
+
+	template <typename U>
+	friend constexpr bool operator==(arena_allocator const &a, arena_allocator<U> const &b) noexcept
+	{
+		return a.arena == b.arena;
+	}
+};
+
+} // namespace bench
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <fast_io.h>
+#include <page_arena.h>
+
+// Command line and report plumbing for the page mode switch of the benchmarks.
+//
+// Every bench takes a mode argument: default|4k|thp|hugetlb|compare.
+// "compare" runs 4k, thp and hugetlb back to back and prints the throughput
+// delta of each huge page mode relative to 4K pages.
+namespace bench
+{
+
+inline constexpr page_mode compare_modes[]{page_mode::small_pages, page_mode::thp, page_mode::hugetlb};
+
+struct page_mode_arg
+{
+	page_mode mode{page_mode::heap};
+	bool compare{};
+};
+
+// An empty argument selects "default". Prints the accepted values on error.
+inline bool parse_page_mode_arg(std::string_view arg, page_mode_arg &out)
+{
+	out = {};
+	if (arg.empty())
+	{
+		return true;
+	}
+	if (arg == "compare")
+	{
+		out.compare = true;
+		return true;
+	}
+	if (parse_page_mode(arg, out.mode))
+	{
+		return true;
+	}
+	::fast_io::io::perr("unknown page mode: ", arg, " (expected default, 4k, thp, hugetlb or compare)\n");
+	return false;
+}
+
+// Rounds count from the command line; invalid input keeps `fallback`.
+inline std::uint32_t parse_rounds_arg(char const *arg, std::uint32_t fallback)
+{
+	try
+	{
+		std::uint32_t rounds = ::fast_io::to<std::uint32_t>(::fast_io::mnp::os_c_str(arg));
+		return rounds == 0 ? fallback : rounds;
+	}
+	catch (...)
+	{
+		return fallback;
+	}
+}
+
+inline double to_seconds(::fast_io::unix_timestamp t) noexcept
+{
+	constexpr double subseconds_to_seconds = 1.0 / static_cast<double>(::fast_io::uint_least64_subseconds_per_second);
+	return static_cast<double>(t.seconds) + static_cast<double>(t.subseconds) * subseconds_to_seconds;
+}
+
+inline double round2(double x) noexcept
+{
+	return std::round(x * 100.0) / 100.0;
+}
+
+// Fastest of `rounds` calls to `f`, which returns a checksum kept alive in a sink.
+template <typename F>
+inline ::fast_io::unix_timestamp best_of_rounds(std::uint32_t rounds, F f)
+{
+	::fast_io::unix_timestamp best{};
+	for (std::uint32_t round{}; round == 0 || round < rounds; ++round)
+	{
+		auto start = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+		std::uint64_t volatile sink = f();
+		auto stop = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+		(void)sink;
+		auto elapsed = stop - start;
+		if (round == 0 || elapsed < best)
+		{
+			best = elapsed;
+		}
+	}
+	return best;
+}
+
+// "[page mode: hugetlb (fell back to thp)]"
+inline void print_page_mode(page_mode requested, page_mode effective)
+{
+	::fast_io::io::print("[page mode: ", page_mode_name(requested));
+	if (effective != requested)
+	{
+		::fast_io::io::print(" (fell back to ", page_mode_name(effective), ")");
+	}
+	::fast_io::io::print("]");
+}
+
+// One pass of a compare run: the mode asked for, the mode the arena actually
+// got, and the best seconds of every benchmarked row.
+struct mode_timings
+{
+	page_mode requested{};
+	page_mode effective{};
+	std::vector<double> seconds;
+};
+
+// Throughput change of every row against the first (4k) pass. A pass whose
+// arena fell back to another mode is reported as unavailable, not as a
+// second run of the fallback mode under the requested name.
+inline void print_delta_report(std::span<std::string_view const> names, std::span<mode_timings const> results)
+{
+	using ::fast_io::io::print;
+	print("[throughput delta vs 4k pages]\n");
+	if (results.empty())
+	{
+		return;
+	}
+	auto const &base = results.front();
+	for (auto const &r : results.subspan(1))
+	{
+		if (r.effective != r.requested)
+		{
+			print(page_mode_name(r.requested), ": unavailable, ran ", page_mode_name(r.effective), "; not reported\n");
+		}
+	}
+	for (std::size_t i{}; i != names.size(); ++i)
+	{
+		print(names[i], ":");
+		for (auto const &r : results.subspan(1))
+		{
+			if (r.effective != r.requested)
+			{
+				continue;
+			}
+			double const delta = r.seconds[i] > 0 ? (base.seconds[i] / r.seconds[i] - 1.0) * 100.0 : 0;
+			print(" ", page_mode_name(r.requested), (delta >= 0 ? std::string_view(" +") : std::string_view(" ")),
+				  round2(delta), "%");
+		}
+		print("\n");
+	}
+}
+
+} // namespace bench
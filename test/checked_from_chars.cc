@@ -0,0 +1,88 @@
+#include <fast_io.h>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <checked_from_chars.h>
+
+using namespace fast_io::io;
+
+static std::size_t failures{};
+
+// `offset` is where ptr must land: the end of the digits on success, the first
+// digit that no longer fits on overflow, and 0 for invalid input.
+template <typename T>
+static void expect(std::string_view s, std::errc ec, std::size_t offset, T value = T{})
+{
+	T v{static_cast<T>(7)};
+	auto res = bench::checked_from_chars(s.data(), s.data() + s.size(), v);
+	std::size_t const got_offset = static_cast<std::size_t>(res.ptr - s.data());
+	T const want = ec == std::errc{} ? value : static_cast<T>(7); // untouched on error
+	if (res.ec != ec || got_offset != offset || v != want)
+	{
+		++failures;
+		perr("FAIL ", std::is_signed_v<T> ? std::string_view("i64") : std::string_view("u64"), " \"", s,
+			 "\": ec=", static_cast<int>(res.ec), " offset=", got_offset, " value=", v, "\n");
+	}
+}
+
+int main()
+{
+	constexpr auto u64_max = std::numeric_limits<std::uint64_t>::max();
+	constexpr auto i64_max = std::numeric_limits<std::int64_t>::max();
+	constexpr auto i64_min = std::numeric_limits<std::int64_t>::min();
+
+	// limits
+	expect<std::uint64_t>("18446744073709551615", std::errc{}, 20, u64_max);
+	expect<std::int64_t>("9223372036854775807", std::errc{}, 19, i64_max);
+	expect<std::int64_t>("-9223372036854775808", std::errc{}, 20, i64_min);
+	expect<std::uint64_t>("0", std::errc{}, 1, 0);
+	expect<std::int64_t>("-0", std::errc{}, 2, 0);
+	expect<std::uint64_t>("000000000000000000000000000018446744073709551615", std::errc{}, 48, u64_max);
+
+	// one past the limits: ptr is the first digit that no longer fits
+	expect<std::uint64_t>("18446744073709551616", std::errc::result_out_of_range, 19);
+	expect<std::int64_t>("9223372036854775808", std::errc::result_out_of_range, 18);
+	expect<std::int64_t>("-9223372036854775809", std::errc::result_out_of_range, 19);
+	expect<std::uint64_t>("99999999999999999999999", std::errc::result_out_of_range, 19);
+	expect<std::uint64_t>("184467440737095516150", std::errc::result_out_of_range, 20);
+	expect<std::int64_t>("18446744073709551615", std::errc::result_out_of_range, 19);
+
+	// invalid input leaves ptr at the start
+	expect<std::int64_t>("-", std::errc::invalid_argument, 0);
+	expect<std::uint64_t>("-", std::errc::invalid_argument, 0);
+	expect<std::uint64_t>("-1", std::errc::invalid_argument, 0);
+	expect<std::uint64_t>("", std::errc::invalid_argument, 0);
+	expect<std::int64_t>("+17", std::errc::invalid_argument, 0);
+	expect<std::int64_t>(" 17", std::errc::invalid_argument, 0);
+
+	// the digit run stops at the first non-digit, in and after a SWAR chunk
+	expect<std::uint64_t>("1234567x89", std::errc{}, 7, 1234567);
+	expect<std::uint64_t>("123456789012x", std::errc{}, 12, 123456789012);
+	expect<std::int64_t>("-42\n", std::errc{}, 3, -42);
+
+	// agrees with std::from_chars on value and error code
+	for (std::string_view s : {"1", "12345678", "123456789", "18446744073709551615", "18446744073709551616",
+							   "-9223372036854775808", "-9223372036854775809", "007", "x"})
+	{
+		std::uint64_t a{}, b{};
+		auto ra = bench::checked_from_chars(s.data(), s.data() + s.size(), a);
+		auto rb = std::from_chars(s.data(), s.data() + s.size(), b);
+		std::int64_t c{}, d{};
+		auto rc = bench::checked_from_chars(s.data(), s.data() + s.size(), c);
+		auto rd = std::from_chars(s.data(), s.data() + s.size(), d);
+		if (ra.ec != rb.ec || a != b || rc.ec != rd.ec || c != d)
+		{
+			++failures;
+			perr("FAIL std::from_chars mismatch on \"", s, "\"\n");
+		}
+	}
+
+	if (failures != 0)
+	{
+		perr(failures, " checked_from_chars checks failed\n");
+		return 1;
+	}
+	print("checked_from_chars: all checks passed\n");
+}
@@ -1,7 +1,11 @@
+-- shared headers under test (e.g. checked_from_chars.h) live with the benchmarks
+local common = path.join(os.projectdir(), "benchmark", "common")
+
 for _, file in ipairs(os.files("**/*.cc")) do
 	local base = path.basename(file)
 	target("test." .. base)
 		set_kind("binary")
 		set_group("test")
 		add_files(file)
+		add_includedirs(common)
 end